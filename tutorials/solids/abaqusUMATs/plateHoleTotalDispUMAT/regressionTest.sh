@@ -0,0 +1,96 @@
+#!/usr/bin/env bash
+set -euo pipefail
+IFS=$'\n\t'
+
+# ============================================================
+# Plate-with-hole UMAT regression test
+# Checks that calling the UMAT with multiple threads gives results that are
+# bitwise identical to calling the UMAT in serial
+# ============================================================
+
+# Number of threads for the threaded run
+UMAT_THREADS="${UMAT_THREADS:-2}"
+
+# Fields to compare
+FIELDS=("D" "sigma")
+
+# Log files
+SOLVER_LOGFILE="log.solids4Foam"
+
+echo "============================================================"
+echo "Plate-with-hole UMAT regression test"
+echo "Serial vs ${UMAT_THREADS} threads: bitwise identical ${FIELDS[*]}"
+echo "============================================================"
+echo
+
+if [[ -z "${S4F_USE_GFORTRAN+x}" ]]; then
+    echo "SKIP: the S4F_USE_GFORTRAN variable is not set"
+    exit 0
+fi
+
+# ------------------------------------------------------------
+# Run the case in serial and with threads
+# ------------------------------------------------------------
+
+run_case() {
+    local dir="$1"
+    local nThreads="$2"
+
+    rm -rf "${dir}"
+    mkdir -p "${dir}"
+    cp -a 0 constant system Allrun Allclean "${dir}"
+
+    # Write the fields in binary so that the comparison is bitwise
+    sed -i "s/^writeFormat .*/writeFormat     binary;/" \
+        "${dir}/system/controlDict"
+    sed -i "s/^\([[:space:]]*\)umatThreads .*/\1umatThreads     ${nThreads};/" \
+        "${dir}/constant/mechanicalProperties"
+
+    (cd "${dir}" && ./Allrun > log.Allrun 2>&1)
+}
+
+./Allclean > /dev/null 2>&1 || true
+run_case "serialRun" 1
+run_case "threadedRun" "${UMAT_THREADS}"
+
+if ! grep -q "calling the UMAT with ${UMAT_THREADS} threads" \
+    "threadedRun/${SOLVER_LOGFILE}"; then
+    echo "SKIP: abaqusUMATs was not compiled with S4F_USE_OPENMP"
+    exit 0
+fi
+
+# ------------------------------------------------------------
+# Checks
+# ------------------------------------------------------------
+
+latestTime=$(cd serialRun && ls -d [0-9]* | sort -g | tail -n 1)
+
+failures=0
+
+for field in "${FIELDS[@]}"; do
+    serialField="serialRun/${latestTime}/${field}"
+    threadedField="threadedRun/${latestTime}/${field}"
+
+    if [[ ! -f "${serialField}" || ! -f "${threadedField}" ]]; then
+        echo "FAIL: ${field} not found at time ${latestTime}"
+        failures=$((failures + 1))
+    elif cmp -s "${serialField}" "${threadedField}"; then
+        echo "PASS: ${field} is identical at time ${latestTime}"
+    else
+        echo "FAIL: ${field} differs at time ${latestTime}"
+        failures=$((failures + 1))
+    fi
+done
+
+echo
+if (( failures == 0 )); then
+    echo "============================================================"
+    echo "Regression test PASSED"
+    echo "============================================================"
+    exit 0
+else
+    echo "============================================================"
+    echo "Regression test FAILED (${failures} checks)"
+    echo "============================================================"
+    exit 1
+fi
@@ -5,6 +5,8 @@ IFS=$'\n\t'
 # ============================================================
 # Elastoplastic perforated plate regression test
 # Checks strain, stress, and plastic yielding
+# Checks the analytical vs numerical consistent tangents of the Mises
+# plasticity laws (vertex-centred runs, requires PETSc)
 # ============================================================
 
 # Reference ranges (order-of-magnitude + robustness)
@@ -17,6 +19,15 @@ SIGMA_MAX=2.2e8
 YIELD_MIN=28
 YIELD_MAX=32
 
+# Maximum relative difference between the analytical and numerical tangents
+TANGENT_REL_TOL=1e-4
+
+# Tangent check runs: name, solidModel, mechanical law
+TANGENT_RUNS=(
+    "linGeomTangentRun vertexCentredLinearGeometry linearElasticMisesPlastic"
+    "totalLagTangentRun vertexCentredNonLinTotalLagGeometry neoHookeanElasticMisesPlastic"
+)
+
 # Log files
 SOLVER_LOGFILE="log.solids4Foam"
 ALLRUN_LOGFILE="log.Allrun"
@@ -26,6 +37,7 @@ echo "Elastoplastic perforated plate regression test"
 echo "Max epsilonEq           in [${EPSILON_MIN}, ${EPSILON_MAX}]"
 echo "Max sigmaEq (von Mises) in [${SIGMA_MIN}, ${SIGMA_MAX}]"
 echo "Yielding cells          in [${YIELD_MIN}, ${YIELD_MAX}]"
+echo "Tangent rel. difference < ${TANGENT_REL_TOL}"
 echo "============================================================"
 echo
 
@@ -108,6 +120,258 @@ fi
 # Clean case again
 ./Allclean > /dev/null 2>&1 || true
 
+# ------------------------------------------------------------
+# Analytical vs numerical tangent checks
+# ------------------------------------------------------------
+
+# Set up a vertex-centred copy of the case with checkTangent enabled
+setup_tangent_case() {
+    local dir="$1"
+    local model="$2"
+    local law="$3"
+
+    rm -rf "${dir}"
+    mkdir -p "${dir}"
+    cp -a 0 constant system Allrun Allclean "${dir}"
+
+    # Load up to the peak traction only
+    sed -i \
+        -e "s/^endTime .*/endTime         10;/" \
+        -e "s/^deltaT .*/deltaT          0.5;/" \
+        -e "s/^writeInterval .*/writeInterval   20;/" \
+        -e "/^functions/,/^}/d" \
+        "${dir}/system/controlDict"
+
+    sed -i \
+        -e "s/^\([[:space:]]*\)type .*/\1type            ${law};/" \
+        -e "s/^\([[:space:]]*\)solvePressureEqn .*/&\n\1checkTangent    yes;\n\1tangentEps      1e-9;/" \
+        "${dir}/constant/mechanicalProperties"
+
+    cat > "${dir}/constant/solidProperties" <<EOF
+FoamFile
+{
+    version     2.0;
+    format      ascii;
+    class       dictionary;
+    location    "constant";
+    object      solidProperties;
+}
+
+solidModel     ${model};
+
+${model}Coeffs
+{
+    solutionAlgorithm PETScSNES;
+    useGeometricStiffness yes;
+    approximateJacobian no;
+    compactImplicitStencil yes;
+    zeta            0.2;
+}
+EOF
+
+    cat > "${dir}/0/D" <<'EOF'
+FoamFile
+{
+    version     2.0;
+    format      ascii;
+    class       volVectorField;
+    location    "0";
+    object      D;
+}
+
+dimensions      [0 1 0 0 0 0 0];
+
+internalField   uniform (0 0 0);
+
+boundaryField
+{
+    ".*"
+    {
+        type            calculated;
+        value           uniform (0 0 0);
+    }
+    back
+    {
+        type            empty;
+    }
+    front
+    {
+        type            empty;
+    }
+}
+EOF
+
+    cat > "${dir}/0/pointD" <<'EOF'
+FoamFile
+{
+    version     2.0;
+    format      ascii;
+    class       pointVectorField;
+    location    "0";
+    object      pointD;
+}
+
+dimensions      [0 1 0 0 0 0 0];
+
+internalField   uniform (0 0 0);
+
+boundaryField
+{
+    left
+    {
+        type            symmetryPlane;
+    }
+    down
+    {
+        type            symmetryPlane;
+    }
+    right
+    {
+        type            pointSolidTraction;
+        tractionSeries
+        {
+            "fileName|file"    "$FOAM_CASE/constant/timeVsTraction";
+            outOfBounds clamp;
+        }
+        pressure        uniform 0;
+    }
+    up
+    {
+        type            pointSolidTraction;
+        traction        uniform (0 0 0);
+        pressure        uniform 0;
+    }
+    hole
+    {
+        type            pointSolidTraction;
+        traction        uniform (0 0 0);
+        pressure        uniform 0;
+    }
+    back
+    {
+        type            empty;
+    }
+    front
+    {
+        type            empty;
+    }
+}
+EOF
+
+    cat > "${dir}/system/fvSchemes" <<'EOF'
+FoamFile
+{
+    version     2.0;
+    format      ascii;
+    class       dictionary;
+    location    "system";
+    object      fvSchemes;
+}
+
+d2dt2Schemes
+{
+    default         steadyState;
+}
+
+ddtSchemes
+{
+    default         steadyState;
+}
+
+gradSchemes
+{
+    default         none;
+}
+
+divSchemes
+{
+    default         none;
+}
+
+laplacianSchemes
+{
+    default         none;
+}
+
+snGradSchemes
+{
+    default         none;
+}
+
+interpolationSchemes
+{
+    default         linear;
+}
+EOF
+
+    cat > "${dir}/system/fvSolution" <<'EOF'
+FoamFile
+{
+    version     2.0;
+    format      ascii;
+    class       dictionary;
+    location    "system";
+    object      fvSolution;
+}
+
+solvers
+{
+    pointD
+    {
+        solver          petsc;
+
+        options
+        {
+            snes_type newtonls;
+            snes_monitor;
+            snes_converged_reason;
+            snes_rtol 1e-8;
+            snes_max_it 100;
+            ksp_type preonly;
+            pc_type lu;
+        }
+    }
+}
+EOF
+}
+
+extract_max_tangent_rel_diff() {
+    grep "maximum difference between the analytical and numerical tangents" \
+        "$1" 2> /dev/null \
+        | sed -e 's/.*(relative: \(.*\))/\1/' \
+        | sort -g \
+        | tail -n 1 \
+        || true
+}
+
+if [[ -z "${PETSC_DIR:-}" ]]; then
+    echo "SKIP: tangent checks as PETSc is not installed"
+else
+    for run in "${TANGENT_RUNS[@]}"; do
+        IFS=' ' read -r name model law <<< "${run}"
+
+        setup_tangent_case "${name}" "${model}" "${law}"
+        (cd "${name}" && ./Allrun > "${ALLRUN_LOGFILE}" 2>&1) || true
+
+        tangent_rel_diff=$(
+            extract_max_tangent_rel_diff "${name}/${SOLVER_LOGFILE}"
+        )
+
+        if [[ -z "${tangent_rel_diff}" ]]; then
+            echo "FAIL: Could not extract the ${law} tangent difference"
+            failures=$((failures + 1))
+        elif awk "BEGIN {exit !(${tangent_rel_diff} < ${TANGENT_REL_TOL})}"
+        then
+            printf "PASS: %s tangent rel. difference = %.6g\n" \
+                "${law}" "${tangent_rel_diff}"
+        else
+            printf "FAIL: %s tangent rel. difference = %.6g\n" \
+                "${law}" "${tangent_rel_diff}"
+            failures=$((failures + 1))
+        fi
+    done
+fi
+
 echo
 if (( failures == 0 ))
 then
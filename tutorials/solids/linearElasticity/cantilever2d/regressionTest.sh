@@ -0,0 +1,247 @@
+#!/usr/bin/env bash
+set -euo pipefail
+IFS=$'\n\t'
+
+# ============================================================
+# Cantilever 2-D vertex-centred Jacobian regression test
+# Checks that the matrix-free and approximate Jacobian options give the same
+# converged pointD as the assembled exact Jacobian, for both vertex-centred
+# solid models
+# ============================================================
+
+# Regression tolerance on max|pointD - pointDRef|/max|pointDRef|
+POINT_DISP_REL_TOL=1e-6
+
+# Solid models: run name prefix, solidModel, mechanical law
+MODELS=(
+    "linGeom vertexCentredLinearGeometry linearElastic"
+    "totalLag vertexCentredNonLinTotalLagGeometry neoHookeanElastic"
+)
+
+# Jacobian options: run name suffix, matrixFreeJacobian, approximateJacobian
+# The first entry is the reference
+JACOBIANS=(
+    "Assembled no no"
+    "MatrixFree yes no"
+    "Approximate no yes"
+)
+
+# Log files
+SOLVER_LOGFILE="log.solids4Foam"
+
+echo "============================================================"
+echo "Cantilever 2-D vertex-centred Jacobian regression test"
+echo "vertexCentredLinearGeometry and vertexCentredNonLinTotalLagGeometry"
+echo "matrixFreeJacobian yes vs no:  pointD rel. LInf < ${POINT_DISP_REL_TOL}"
+echo "approximateJacobian yes vs no: pointD rel. LInf < ${POINT_DISP_REL_TOL}"
+echo "============================================================"
+echo
+
+if [[ -z "${PETSC_DIR:-}" ]]; then
+    echo "SKIP: PETSc is not installed; please set the PETSC_DIR variable"
+    exit 0
+fi
+
+# ------------------------------------------------------------
+# Run the case with each Jacobian option
+# ------------------------------------------------------------
+
+run_case() {
+    local dir="$1"
+    local model="$2"
+    local law="$3"
+    local matrixFree="$4"
+    local approximate="$5"
+
+    rm -rf "${dir}"
+    mkdir -p "${dir}"
+    cp -a 0 constant system src Allrun Allclean "${dir}"
+
+    # Write pointD with enough digits for the comparison
+    sed -i "s/^writePrecision .*/writePrecision  12;/" \
+        "${dir}/system/controlDict"
+
+    sed -i \
+        -e "s/vertexCentredLinearGeometry/${model}/g" \
+        -e "s/^\([[:space:]]*\)matrixFreeJacobian .*/\1matrixFreeJacobian ${matrixFree};/" \
+        -e "s/^\([[:space:]]*\)approximateJacobian .*/\1approximateJacobian ${approximate};/" \
+        "${dir}/constant/solidProperties.vertexCentred"
+
+    sed -i "s/^\([[:space:]]*\)type .*/\1type            ${law};/" \
+        "${dir}/constant/mechanicalProperties"
+
+    # The total Lagrangian model requires the geometric stiffness switch
+    sed -i \
+        "s/^\([[:space:]]*\)solutionAlgorithm .*/&\n\1useGeometricStiffness yes;/" \
+        "${dir}/constant/solidProperties.vertexCentred"
+
+    # The matrix-free and approximate Jacobians need Newton iterations and a
+    # Krylov solver, so all runs use the same converged solver settings
+    cat > "${dir}/system/fvSolution.vertexCentred" <<'EOF'
+FoamFile
+{
+    version     2.0;
+    format      ascii;
+    class       dictionary;
+    location    "system";
+    object      fvSolution;
+}
+
+solvers
+{
+    pointD
+    {
+        solver          petsc;
+
+        options
+        {
+            snes_type newtonls;
+            snes_linesearch_type basic;
+            snes_monitor;
+            snes_converged_reason;
+            snes_rtol 1e-10;
+            snes_atol 1e-50;
+            snes_stol 0;
+            snes_max_it 500;
+            ksp_type gmres;
+            ksp_rtol 1e-12;
+            ksp_max_it 1000;
+            pc_type lu;
+        }
+    }
+}
+EOF
+
+    (cd "${dir}" && ./Allrun vertexCentred > log.Allrun 2>&1)
+}
+
+./Allclean > /dev/null 2>&1 || true
+
+for modelEntry in "${MODELS[@]}"; do
+    IFS=' ' read -r prefix model law <<< "${modelEntry}"
+
+    for jacEntry in "${JACOBIANS[@]}"; do
+        IFS=' ' read -r suffix matrixFree approximate <<< "${jacEntry}"
+        echo "Running ${prefix}${suffix}: ${model}, ${law}," \
+             "matrixFreeJacobian ${matrixFree}," \
+             "approximateJacobian ${approximate}"
+        run_case "${prefix}${suffix}" "${model}" "${law}" \
+            "${matrixFree}" "${approximate}"
+    done
+done
+echo
+
+# ------------------------------------------------------------
+# Extract helpers
+# ------------------------------------------------------------
+
+# Print the max difference between the internalField vectors of two fields,
+# relative to the max magnitude in the first field
+field_rel_linf() {
+    awk '
+        function readVectors(file, v,    n, inField, line)
+        {
+            n = 0
+            inField = 0
+            while ((getline line < file) > 0)
+            {
+                if (line ~ /^internalField/) { inField = 1; continue }
+                if (!inField) { continue }
+                if (line ~ /^\)/) { break }
+                if (line ~ /^\(.*\)$/)
+                {
+                    gsub(/[()]/, "", line)
+                    split(line, c, " ")
+                    v[n, 0] = c[1]; v[n, 1] = c[2]; v[n, 2] = c[3]
+                    n++
+                }
+            }
+            close(file)
+            return n
+        }
+        BEGIN {
+            nA = readVectors(ARGV[1], a)
+            nB = readVectors(ARGV[2], b)
+            if (nA == 0 || nA != nB) { print "nan"; exit }
+            maxDiff = 0
+            maxMag = 0
+            for (i = 0; i < nA; i++)
+            {
+                diff = 0
+                mag = 0
+                for (j = 0; j < 3; j++)
+                {
+                    diff += (a[i, j] - b[i, j])^2
+                    mag += a[i, j]^2
+                }
+                if (sqrt(diff) > maxDiff) { maxDiff = sqrt(diff) }
+                if (sqrt(mag) > maxMag) { maxMag = sqrt(mag) }
+            }
+            if (maxMag == 0) { print "nan"; exit }
+            printf "%.6g\n", maxDiff/maxMag
+        }
+    ' "$1" "$2"
+}
+
+# ------------------------------------------------------------
+# Checks
+# ------------------------------------------------------------
+
+failures=0
+
+for modelEntry in "${MODELS[@]}"; do
+    IFS=' ' read -r prefix model law <<< "${modelEntry}"
+
+    refRun=""""
+
+    for jacEntry in "${JACOBIANS[@]}"; do
+        IFS=' ' read -r suffix matrixFree approximate <<< "${jacEntry}"
+        name="${prefix}${suffix}"
+
+        if ! grep -q "CONVERGED" "${name}/${SOLVER_LOGFILE}"; then
+            echo "FAIL: ${name} did not converge"
+            failures=$((failures + 1))
+            continue
+        fi
+
+        if [[ -z "${refRun}" ]]; then
+            refRun="${name}"
+            continue
+        fi
+
+        latestTime=$(cd "${refRun}" && ls -d [0-9]* | sort -g | tail -n 1)
+        refField="${refRun}/${latestTime}/pointD"
+        field="${name}/${latestTime}/pointD"
+
+        if [[ ! -f "${refField}" || ! -f "${field}" ]]; then
+            echo "FAIL: pointD not found at time ${latestTime} for ${name}"
+            failures=$((failures + 1))
+            continue
+        fi
+
+        rel_linf=$(field_rel_linf "${refField}" "${field}")
+
+        if [[ "${rel_linf}" == "nan" ]]; then
+            echo "FAIL: Could not compare pointD for ${name}"
+            failures=$((failures + 1))
+        elif awk "BEGIN {exit !(${rel_linf} < ${POINT_DISP_REL_TOL})}"; then
+            printf "PASS: %s pointD rel. LInf = %s\n" "${name}" "${rel_linf}"
+        else
+            printf "FAIL: %s pointD rel. LInf = %s\n" "${name}" "${rel_linf}"
+            failures=$((failures + 1))
+        fi
+    done
+done
+
+echo
+if (( failures == 0 )); then
+    echo "============================================================"
+    echo "Regression test PASSED"
+    echo "============================================================"
+    exit 0
+else
+    echo "============================================================"
+    echo "Regression test FAILED (${failures} checks)"
+    echo "============================================================"
+    exit 1
+fi
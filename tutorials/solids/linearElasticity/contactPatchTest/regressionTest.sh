@@ -5,6 +5,7 @@ IFS=$'\n\t'
 # ============================================================
 # Contact patch test regression test
 # Checks numerical vs analytical solution
+# Checks the BVH quick reject gives the same solution as the AABB reference
 # ============================================================
 
 # Reference ranges
@@ -17,6 +18,12 @@ SIGMA_MAX=10000
 SIGMA_Y_REL_ERROR_MIN=0
 SIGMA_Y_REL_ERROR_MAX=2
 
+# Regression tolerance on max|D - DRef|/max|DRef| for the BVH quick reject
+BVH_DISP_REL_TOL=1e-5
+
+# Directory of the BVH quick reject run
+BVH_RUN="bvhRun"
+
 # Log files
 SOLVER_LOGFILE="log.solids4Foam"
 ALLRUN_LOGFILE="log.Allrun"
@@ -27,6 +34,7 @@ echo "Max epsilonEq           in [${EPSILON_MIN}, ${EPSILON_MAX}]"
 echo "Max sigmaEq (von Mises) in [${SIGMA_MIN}, ${SIGMA_MAX}]"
 echo "Max sigma_y relative error (in %) in " \
      "[${SIGMA_Y_REL_ERROR_MIN}, ${SIGMA_Y_REL_ERROR_MAX}]"
+echo "quickReject BVH vs AABB: D rel. LInf < ${BVH_DISP_REL_TOL}"
 echo "============================================================"
 echo
 
@@ -49,6 +57,15 @@ done
 if [ "$CHECK_ONLY" = false ]; then
     ./Allclean > /dev/null 2>&1 || true
     ./Allrun > "${ALLRUN_LOGFILE}" 2>&1
+
+    # Repeat the case with the BVH quick reject
+    rm -rf "${BVH_RUN}"
+    mkdir -p "${BVH_RUN}"
+    cp -a 0 constant system Allrun Allclean "${BVH_RUN}"
+    sed -i \
+        "s/^\([[:space:]]*\)quickReject .*/\1quickReject     BVH;/" \
+        "${BVH_RUN}/0/D"
+    (cd "${BVH_RUN}" && ./Allrun > "${ALLRUN_LOGFILE}" 2>&1)
 else
     echo "Running in check-only mode: skipping Allclean and Allrun"
 fi
@@ -76,6 +93,54 @@ extract_relative_sigma_y_error() {
         | tail -n 1
 }
 
+# Print the max difference between the internalField vectors of two fields,
+# relative to the max magnitude in the first field
+field_rel_linf() {
+    awk '
+        function readVectors(file, v,    n, inField, line)
+        {
+            n = 0
+            inField = 0
+            while ((getline line < file) > 0)
+            {
+                if (line ~ /^internalField/) { inField = 1; continue }
+                if (!inField) { continue }
+                if (line ~ /^\)/) { break }
+                if (line ~ /^\(.*\)$/)
+                {
+                    gsub(/[()]/, "", line)
+                    split(line, c, " ")
+                    v[n, 0] = c[1]; v[n, 1] = c[2]; v[n, 2] = c[3]
+                    n++
+                }
+            }
+            close(file)
+            return n
+        }
+        BEGIN {
+            nA = readVectors(ARGV[1], a)
+            nB = readVectors(ARGV[2], b)
+            if (nA == 0 || nA != nB) { print "nan"; exit }
+            maxDiff = 0
+            maxMag = 0
+            for (i = 0; i < nA; i++)
+            {
+                diff = 0
+                mag = 0
+                for (j = 0; j < 3; j++)
+                {
+                    diff += (a[i, j] - b[i, j])^2
+                    mag += a[i, j]^2
+                }
+                if (sqrt(diff) > maxDiff) { maxDiff = sqrt(diff) }
+                if (sqrt(mag) > maxMag) { maxMag = sqrt(mag) }
+            }
+            if (maxMag == 0) { print "nan"; exit }
+            printf "%.6g\n", maxDiff/maxMag
+        }
+    ' "$1" "$2"
+}
+
 # ------------------------------------------------------------
 # Extract values
 # ------------------------------------------------------------
@@ -126,6 +191,31 @@ else
     failures=$((failures + 1))
 fi
 
+# --- BVH vs AABB quick reject ---
+latestTime=$(ls -d [0-9]* | sort -g | tail -n 1)
+refField="${latestTime}/D"
+bvhField="${BVH_RUN}/${latestTime}/D"
+
+if [[ ! -f "${refField}" || ! -f "${bvhField}" ]]
+then
+    echo "FAIL: D not found at time ${latestTime} for the BVH run"
+    failures=$((failures + 1))
+else
+    bvh_rel_linf=$(field_rel_linf "${refField}" "${bvhField}")
+
+    if [[ "${bvh_rel_linf}" == "nan" ]]
+    then
+        echo "FAIL: Could not compare D for the BVH run"
+        failures=$((failures + 1))
+    elif awk "BEGIN {exit !(${bvh_rel_linf} < ${BVH_DISP_REL_TOL})}"
+    then
+        printf "PASS: BVH D rel. LInf = %s\n" "${bvh_rel_linf}"
+    else
+        printf "FAIL: BVH D rel. LInf = %s\n" "${bvh_rel_linf}"
+        failures=$((failures + 1))
+    fi
+fi
+
 echo
 if (( failures == 0 ));
 then